@@ -4,6 +4,8 @@
 #include <cstdlib>
 #include <conio.h>
 #include <cstring>
+#include <cstdint>
+#include <fstream>
 using namespace std;
 
 // ANSI Color Codes
@@ -16,12 +18,31 @@ using namespace std;
 #define COLOR_WIN "\033[92m"      // Green
 #define COLOR_RULES "\033[94m"    // Blue for rules
 #define COLOR_CREDIT "\033[103m\033[30m" // Yellow background with black text
+#define COLOR_HEAT_WORST "\033[41m\033[97m"  // Red background
+#define COLOR_HEAT_POOR "\033[101m\033[30m"  // Light red background
+#define COLOR_HEAT_FAIR "\033[43m\033[30m"   // Yellow background
+#define COLOR_HEAT_GOOD "\033[102m\033[30m"  // Light green background
+#define COLOR_HEAT_BEST "\033[42m\033[30m"   // Green background
 
 // Game constants
 #define MAX_BOARD_SIZE 7
 #define MAX_NAME_LENGTH 50
 #define PLAYER1_SYMBOL 'X'
 #define PLAYER2_SYMBOL 'O'
+#define HEAT_MAP_KEY '?'
+
+// Position cache constants
+#define CACHE_BUCKET_SIZE 4
+#define CACHE_BUCKETS (1 << 14)
+#define CACHE_ENTRIES (CACHE_BUCKETS * CACHE_BUCKET_SIZE)
+#define CACHE_FILE_NAME "tictactoe_cache.bin"
+#define CACHE_FILE_MAGIC 0x3243435454544349ULL // "ICTTTCC2"
+
+// Search constants
+#define WIN_SCORE 10000
+#define INFINITE_SCORE 30000
+#define MULTIPV_MARGIN 100 // Root moves scoring below best - margin only get an upper bound
+#define HEAT_LEVELS 5
 
 // Game state
 enum GameState { PLAYING, PLAYER1_WON, PLAYER2_WON, DRAW };
@@ -42,8 +63,49 @@ struct GameSettings {
     bool soundsEnabled;
     bool colorEnabled;
     GridSize gridSize;
+    bool cacheSnapshotEnabled;
 };
 
+// Position cache: one fixed-size table shared by every game in the process.
+// Positions are keyed by a Zobrist hash of the board's canonical orientation
+// (smallest hash over the 8 rotations/reflections), so symmetric positions
+// share an entry. Each slot stores key ^ data next to data, so a slot
+// holding another position fails the key check and reads as a miss.
+// The game is single-threaded; the table is not safe for concurrent use.
+struct CacheEntry {
+    uint64_t check;
+    uint64_t data;
+};
+
+struct CacheStats {
+    unsigned long long lookups;
+    unsigned long long hits;
+    unsigned long long stores;
+    unsigned long long replacements; // live entries evicted by another position
+};
+
+// Entry data layout: bit 63 valid, bits 40-41 bound, bits 32-39 depth, bits 16-31 score,
+// bits 8-15 age, bits 0-7 canonical move (cell + 1, 0 = none)
+#define CACHE_VALID_BIT (1ULL << 63)
+#define CACHE_MOVE(data) ((int)((data) & 0xFF))
+#define CACHE_AGE(data) ((unsigned)(((data) >> 8) & 0xFF))
+#define CACHE_SCORE(data) ((int)(int16_t)(((data) >> 16) & 0xFFFF))
+#define CACHE_DEPTH(data) ((int)(((data) >> 32) & 0xFF))
+#define CACHE_BOUND(data) ((int)(((data) >> 40) & 0x3))
+#define CACHE_PACK_SEARCH(move, score, depth, bound) ((uint64_t)(move) | ((uint64_t)(uint16_t)(int16_t)(score) << 16) \
+    | ((uint64_t)(depth) << 32) | ((uint64_t)(bound) << 40))
+
+enum BoundType { BOUND_EXACT, BOUND_LOWER, BOUND_UPPER };
+
+CacheEntry positionCache[CACHE_ENTRIES];
+CacheStats cacheStats = { 0, 0, 0, 0 };
+uint64_t zobristKeys[MAX_BOARD_SIZE * MAX_BOARD_SIZE][2];
+uint64_t zobristSizeKeys[MAX_BOARD_SIZE + 1];
+uint64_t zobristSideKey;
+uint64_t zobristSmartMoveKey;
+uint64_t zobristSearchKey;
+unsigned cacheGeneration = 0;
+
 // Safe string copy function
 void safeStringCopy(char* dest, const char* src, size_t destSize) {
     size_t i;
@@ -110,7 +172,13 @@ void initializeBoard(char grid[MAX_BOARD_SIZE][MAX_BOARD_SIZE], int size) {
     }
 }
 
-void displayBoard(const char grid[MAX_BOARD_SIZE][MAX_BOARD_SIZE], int size, bool useColor = true) {
+// heatMap (optional) holds a 0..HEAT_LEVELS-1 quality level per empty cell, -1 for no overlay
+void displayBoard(const char grid[MAX_BOARD_SIZE][MAX_BOARD_SIZE], int size, bool useColor = true,
+    const int heatMap[MAX_BOARD_SIZE][MAX_BOARD_SIZE] = NULL) {
+    const char* heatColors[HEAT_LEVELS] = {
+        COLOR_HEAT_WORST, COLOR_HEAT_POOR, COLOR_HEAT_FAIR, COLOR_HEAT_GOOD, COLOR_HEAT_BEST
+    };
+
     if (useColor) cout << COLOR_BOARD;
 
     // Draw top border
@@ -125,7 +193,13 @@ void displayBoard(const char grid[MAX_BOARD_SIZE][MAX_BOARD_SIZE], int size, boo
                 else if (grid[i][j] == PLAYER2_SYMBOL) cout << COLOR_PLAYER2;
             }
 
-            cout << "| " << grid[i][j] << " ";
+            cout << "|";
+            if (useColor && heatMap != NULL && heatMap[i][j] >= 0) {
+                cout << heatColors[heatMap[i][j]] << " " << grid[i][j] << " " << COLOR_RESET;
+            }
+            else {
+                cout << " " << grid[i][j] << " ";
+            }
 
             if (useColor) cout << COLOR_BOARD;
         }
@@ -139,8 +213,12 @@ void displayBoard(const char grid[MAX_BOARD_SIZE][MAX_BOARD_SIZE], int size, boo
 }
 
 // Game logic
+int getRequiredToWin(int size) {
+    return (size == 3) ? 3 : (size == 5) ? 4 : 5;
+}
+
 bool checkWin(const char grid[MAX_BOARD_SIZE][MAX_BOARD_SIZE], int size, char symbol) {
-    int requiredToWin = (size == 3) ? 3 : (size == 5) ? 4 : 5;
+    int requiredToWin = getRequiredToWin(size);
 
     // Check rows
     for (int i = 0; i < size; i++) {
@@ -201,6 +279,27 @@ bool checkWin(const char grid[MAX_BOARD_SIZE][MAX_BOARD_SIZE], int size, char sy
     return false;
 }
 
+// Only checks lines through (row, col); used by the search after placing a single move
+bool checkWinAt(const char grid[MAX_BOARD_SIZE][MAX_BOARD_SIZE], int size, int row, int col, char symbol) {
+    int requiredToWin = getRequiredToWin(size);
+    const int directions[4][2] = { { 0, 1 }, { 1, 0 }, { 1, 1 }, { 1, -1 } };
+
+    for (int d = 0; d < 4; d++) {
+        int count = 1;
+        for (int sign = -1; sign <= 1; sign += 2) {
+            int r = row + sign * directions[d][0];
+            int c = col + sign * directions[d][1];
+            while (r >= 0 && r < size && c >= 0 && c < size && grid[r][c] == symbol) {
+                count++;
+                r += sign * directions[d][0];
+                c += sign * directions[d][1];
+            }
+        }
+        if (count >= requiredToWin) return true;
+    }
+    return false;
+}
+
 bool isBoardFull(const char grid[MAX_BOARD_SIZE][MAX_BOARD_SIZE], int size) {
     for (int i = 0; i < size; i++) {
         for (int j = 0; j < size; j++) {
@@ -229,8 +328,9 @@ int getPlayerMove(const char grid[MAX_BOARD_SIZE][MAX_BOARD_SIZE], int size, con
             << (symbol == PLAYER1_SYMBOL ? COLOR_PLAYER1 : COLOR_PLAYER2)
             << symbol << COLOR_TEXT << "): ";
         cout << COLOR_PLAYER2 << "\nPress Esc key to exit game.....\n"<< COLOR_RESET;
+        cout << COLOR_TEXT << "Press " << HEAT_MAP_KEY << " to toggle the move heat map\n" << COLOR_RESET;
         int input = _getch();
-        if (input == 27) {
+        if (input == 27 || input == HEAT_MAP_KEY) {
             return input;
         }
         if (input >= '1' && input <= '9') {
@@ -267,6 +367,159 @@ int getPlayerMove(const char grid[MAX_BOARD_SIZE][MAX_BOARD_SIZE], int size, con
     }
 }
 
+// Position cache
+uint64_t splitMix64(uint64_t& state) {
+    // Fixed-seed generator so hashes stay valid across runs (needed for snapshots)
+    uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+void initPositionCache() {
+    uint64_t state = 0x5443545443414348ULL;
+    for (int i = 0; i < MAX_BOARD_SIZE * MAX_BOARD_SIZE; i++) {
+        zobristKeys[i][0] = splitMix64(state);
+        zobristKeys[i][1] = splitMix64(state);
+    }
+    for (int i = 0; i <= MAX_BOARD_SIZE; i++) {
+        zobristSizeKeys[i] = splitMix64(state);
+    }
+    zobristSideKey = splitMix64(state);
+    zobristSmartMoveKey = splitMix64(state);
+    zobristSearchKey = splitMix64(state);
+    memset(positionCache, 0, sizeof(positionCache));
+}
+
+// Maps a cell through one of the 8 board symmetries (bit 2 = mirror, bits 0-1 = quarter turns)
+void transformCell(int row, int col, int size, int symmetry, int& outRow, int& outCol) {
+    if (symmetry & 4) col = size - 1 - col;
+    for (int k = 0; k < (symmetry & 3); k++) {
+        int temp = row;
+        row = col;
+        col = size - 1 - temp;
+    }
+    outRow = row;
+    outCol = col;
+}
+
+uint64_t canonicalHash(const char grid[MAX_BOARD_SIZE][MAX_BOARD_SIZE], int size, char sideSymbol, int& symmetry) {
+    uint64_t best = 0;
+    symmetry = 0;
+    for (int t = 0; t < 8; t++) {
+        uint64_t hash = zobristSizeKeys[size];
+        if (sideSymbol == PLAYER1_SYMBOL) hash ^= zobristSideKey;
+        for (int i = 0; i < size; i++) {
+            for (int j = 0; j < size; j++) {
+                if (grid[i][j] != PLAYER1_SYMBOL && grid[i][j] != PLAYER2_SYMBOL) continue;
+                int row, col;
+                transformCell(i, j, size, t, row, col);
+                hash ^= zobristKeys[row * size + col][grid[i][j] == PLAYER1_SYMBOL ? 0 : 1];
+            }
+        }
+        if (t == 0 || hash < best) {
+            best = hash;
+            symmetry = t;
+        }
+    }
+    return best;
+}
+
+// Converts a 1-based board move to a 0-based cell in the canonical orientation
+int toCanonicalCell(int move, int size, int symmetry) {
+    int row, col;
+    transformCell((move - 1) / size, (move - 1) % size, size, symmetry, row, col);
+    return row * size + col;
+}
+
+// Converts a 0-based canonical cell back to a 1-based move on the actual board
+int fromCanonicalCell(int cell, int size, int symmetry) {
+    for (int i = 0; i < size * size; i++) {
+        int row, col;
+        transformCell(i / size, i % size, size, symmetry, row, col);
+        if (row * size + col == cell) return i + 1;
+    }
+    return -1;
+}
+
+void cacheNewGeneration() {
+    cacheGeneration = (cacheGeneration + 1) & 0xFF;
+}
+
+bool cacheProbe(uint64_t key, uint64_t& data) {
+    CacheEntry* bucket = &positionCache[(key % CACHE_BUCKETS) * CACHE_BUCKET_SIZE];
+    cacheStats.lookups++;
+    for (int i = 0; i < CACHE_BUCKET_SIZE; i++) {
+        uint64_t entryData = bucket[i].data;
+        if ((entryData & CACHE_VALID_BIT) && (bucket[i].check ^ entryData) == key) {
+            cacheStats.hits++;
+            // Refresh the age so entries that keep getting hit survive replacement
+            if (CACHE_AGE(entryData) != cacheGeneration) {
+                entryData = (entryData & ~(0xFFULL << 8)) | ((uint64_t)cacheGeneration << 8);
+                bucket[i].data = entryData;
+                bucket[i].check = key ^ entryData;
+            }
+            data = entryData;
+            return true;
+        }
+    }
+    return false;
+}
+
+void cacheStore(uint64_t key, uint64_t payload) {
+    CacheEntry* bucket = &positionCache[(key % CACHE_BUCKETS) * CACHE_BUCKET_SIZE];
+    int victim = 0;
+    unsigned oldest = 0;
+    for (int i = 0; i < CACHE_BUCKET_SIZE; i++) {
+        uint64_t entryData = bucket[i].data;
+        if (!(entryData & CACHE_VALID_BIT) || (bucket[i].check ^ entryData) == key) {
+            victim = i;
+            oldest = 256; // Empty or same position always wins
+            break;
+        }
+        unsigned age = (cacheGeneration - CACHE_AGE(entryData)) & 0xFF;
+        if (age >= oldest) {
+            victim = i;
+            oldest = age;
+        }
+    }
+    if (oldest != 256) cacheStats.replacements++;
+
+    uint64_t data = CACHE_VALID_BIT | ((uint64_t)cacheGeneration << 8) | (payload & ~(0xFFULL << 8));
+    bucket[victim].data = data;
+    bucket[victim].check = key ^ data;
+    cacheStats.stores++;
+}
+
+int countCacheEntries() {
+    int used = 0;
+    for (int i = 0; i < CACHE_ENTRIES; i++) {
+        if (positionCache[i].data & CACHE_VALID_BIT) used++;
+    }
+    return used;
+}
+
+void saveCacheSnapshot() {
+    ofstream file(CACHE_FILE_NAME, ios::binary);
+    if (!file) return;
+    uint64_t header[3] = { CACHE_FILE_MAGIC, CACHE_ENTRIES, cacheGeneration };
+    file.write(reinterpret_cast<const char*>(header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(positionCache), sizeof(positionCache));
+}
+
+void loadCacheSnapshot() {
+    ifstream file(CACHE_FILE_NAME, ios::binary);
+    if (!file) return;
+    uint64_t header[3];
+    if (!file.read(reinterpret_cast<char*>(header), sizeof(header))) return;
+    if (header[0] != CACHE_FILE_MAGIC || header[1] != CACHE_ENTRIES) return;
+    if (!file.read(reinterpret_cast<char*>(positionCache), sizeof(positionCache))) {
+        memset(positionCache, 0, sizeof(positionCache)); // Truncated file, start empty
+        return;
+    }
+    cacheGeneration = (unsigned)(header[2] & 0xFF); // Keep saved entry ages meaningful
+}
+
 // Computer AI
 int getRandomMove(const char grid[MAX_BOARD_SIZE][MAX_BOARD_SIZE], int size) {
     int available[MAX_BOARD_SIZE * MAX_BOARD_SIZE];
@@ -281,7 +534,8 @@ int getRandomMove(const char grid[MAX_BOARD_SIZE][MAX_BOARD_SIZE], int size) {
     return count > 0 ? available[rand() % count] : -1;
 }
 
-int getSmartMove(const char grid[MAX_BOARD_SIZE][MAX_BOARD_SIZE], int size, char computerSymbol, char playerSymbol) {
+// Deterministic part of the smart strategy; returns -1 when only a random move is left
+int findStrategicMove(const char grid[MAX_BOARD_SIZE][MAX_BOARD_SIZE], int size, char computerSymbol, char playerSymbol) {
     // Check if computer can win
     for (int i = 0; i < size * size; i++) {
         int row = i / size;
@@ -328,7 +582,24 @@ int getSmartMove(const char grid[MAX_BOARD_SIZE][MAX_BOARD_SIZE], int size, char
         }
     }
 
-    return getRandomMove(grid, size);
+    return -1;
+}
+
+int getSmartMove(const char grid[MAX_BOARD_SIZE][MAX_BOARD_SIZE], int size, char computerSymbol, char playerSymbol) {
+    int symmetry;
+    uint64_t key = canonicalHash(grid, size, computerSymbol, symmetry) ^ zobristSmartMoveKey;
+    uint64_t data;
+    int move;
+
+    if (cacheProbe(key, data)) {
+        move = CACHE_MOVE(data) ? fromCanonicalCell(CACHE_MOVE(data) - 1, size, symmetry) : -1;
+    }
+    else {
+        move = findStrategicMove(grid, size, computerSymbol, playerSymbol);
+        cacheStore(key, move != -1 ? toCanonicalCell(move, size, symmetry) + 1 : 0);
+    }
+
+    return move != -1 ? move : getRandomMove(grid, size);
 }
 
 int getComputerMove(const char grid[MAX_BOARD_SIZE][MAX_BOARD_SIZE], int size, char computerSymbol, char playerSymbol, Difficulty difficulty) {
@@ -340,11 +611,208 @@ int getComputerMove(const char grid[MAX_BOARD_SIZE][MAX_BOARD_SIZE], int size, c
     return -1;
 }
 
+// Move analysis
+int getAnalysisDepth(int size) {
+    return (size == 3) ? 9 : (size == 5) ? 4 : 3;
+}
+
+// Scores every window that can still become a win: own-only windows count for, opponent-only against
+int evaluatePosition(const char grid[MAX_BOARD_SIZE][MAX_BOARD_SIZE], int size, char side, char opponent) {
+    int requiredToWin = getRequiredToWin(size);
+    const int directions[4][2] = { { 0, 1 }, { 1, 0 }, { 1, 1 }, { 1, -1 } };
+    int score = 0;
+
+    for (int i = 0; i < size; i++) {
+        for (int j = 0; j < size; j++) {
+            for (int d = 0; d < 4; d++) {
+                int endRow = i + (requiredToWin - 1) * directions[d][0];
+                int endCol = j + (requiredToWin - 1) * directions[d][1];
+                if (endRow >= size || endCol < 0 || endCol >= size) continue;
+
+                int own = 0, other = 0;
+                for (int k = 0; k < requiredToWin; k++) {
+                    char cell = grid[i + k * directions[d][0]][j + k * directions[d][1]];
+                    if (cell == side) own++;
+                    else if (cell == opponent) other++;
+                }
+                if (own > 0 && other == 0) score += 1 << (2 * own);
+                else if (other > 0 && own == 0) score -= 1 << (2 * other);
+            }
+        }
+    }
+
+    if (score >= WIN_SCORE) score = WIN_SCORE - 1;
+    if (score <= -WIN_SCORE) score = -WIN_SCORE + 1;
+    return score;
+}
+
+// Fills moves with every empty cell (1-based), firstMove first, then cells with the most occupied neighbours
+int orderMoves(const char grid[MAX_BOARD_SIZE][MAX_BOARD_SIZE], int size, int firstMove, int moves[]) {
+    int keys[MAX_BOARD_SIZE * MAX_BOARD_SIZE];
+    int count = 0;
+    for (int i = 0; i < size * size; i++) {
+        int row = i / size;
+        int col = i % size;
+        if (grid[row][col] == PLAYER1_SYMBOL || grid[row][col] == PLAYER2_SYMBOL) continue;
+
+        int key = 0;
+        if (i + 1 == firstMove) {
+            key = 100;
+        }
+        else {
+            for (int r = row - 1; r <= row + 1; r++) {
+                for (int c = col - 1; c <= col + 1; c++) {
+                    if (r >= 0 && r < size && c >= 0 && c < size &&
+                        (grid[r][c] == PLAYER1_SYMBOL || grid[r][c] == PLAYER2_SYMBOL)) key++;
+                }
+            }
+        }
+
+        int k = count++;
+        while (k > 0 && keys[k - 1] < key) {
+            keys[k] = keys[k - 1];
+            moves[k] = moves[k - 1];
+            k--;
+        }
+        keys[k] = key;
+        moves[k] = i + 1;
+    }
+    return count;
+}
+
+// Negamax alpha-beta from side's point of view. Wins score WIN_SCORE + cells left empty, so
+// faster wins rank higher and every score depends only on the position (safe to cache).
+int searchPosition(char grid[MAX_BOARD_SIZE][MAX_BOARD_SIZE], int size, char side, char opponent,
+    int depth, int alpha, int beta, int emptyCells) {
+    int symmetry;
+    uint64_t key = canonicalHash(grid, size, side, symmetry) ^ zobristSearchKey;
+    uint64_t data;
+    int cacheMove = -1;
+
+    if (cacheProbe(key, data)) {
+        if (CACHE_MOVE(data)) cacheMove = fromCanonicalCell(CACHE_MOVE(data) - 1, size, symmetry);
+        if (CACHE_DEPTH(data) >= depth) {
+            int score = CACHE_SCORE(data);
+            int bound = CACHE_BOUND(data);
+            if (bound == BOUND_EXACT || (bound == BOUND_LOWER && score >= beta) ||
+                (bound == BOUND_UPPER && score <= alpha)) {
+                return score;
+            }
+        }
+    }
+
+    if (depth == 0) return evaluatePosition(grid, size, side, opponent);
+
+    int moves[MAX_BOARD_SIZE * MAX_BOARD_SIZE];
+    int count = orderMoves(grid, size, cacheMove, moves);
+    int originalAlpha = alpha;
+    int best = -INFINITE_SCORE;
+    int bestMove = moves[0];
+
+    for (int i = 0; i < count; i++) {
+        int row = (moves[i] - 1) / size;
+        int col = (moves[i] - 1) % size;
+        char saved = grid[row][col];
+        int score;
+
+        grid[row][col] = side;
+        if (checkWinAt(grid, size, row, col, side)) score = WIN_SCORE + emptyCells - 1;
+        else if (emptyCells == 1) score = 0;
+        else score = -searchPosition(grid, size, opponent, side, depth - 1, -beta, -alpha, emptyCells - 1);
+        grid[row][col] = saved;
+
+        if (score > best) {
+            best = score;
+            bestMove = moves[i];
+        }
+        if (best > alpha) alpha = best;
+        if (alpha >= beta) break;
+    }
+
+    int bound = (best <= originalAlpha) ? BOUND_UPPER : (best >= beta) ? BOUND_LOWER : BOUND_EXACT;
+    cacheStore(key, CACHE_PACK_SEARCH(toCanonicalCell(bestMove, size, symmetry) + 1, best, depth, bound));
+    return best;
+}
+
+// Multi-PV search: scores every empty cell for side in one iterative-deepening pass and turns
+// the scores into heat levels (-1 for occupied cells). Root moves share the position cache, and
+// each one is searched with alpha = best - MULTIPV_MARGIN, so clearly worse moves stop at an
+// upper bound instead of getting an exact score. Returns the depth reached.
+int analyzeMoves(const char grid[MAX_BOARD_SIZE][MAX_BOARD_SIZE], int size, char side, char opponent,
+    int heatMap[MAX_BOARD_SIZE][MAX_BOARD_SIZE]) {
+    char work[MAX_BOARD_SIZE][MAX_BOARD_SIZE];
+    int moves[MAX_BOARD_SIZE * MAX_BOARD_SIZE];
+    int scores[MAX_BOARD_SIZE * MAX_BOARD_SIZE];
+    bool exact[MAX_BOARD_SIZE * MAX_BOARD_SIZE];
+    memcpy(work, grid, sizeof(work));
+
+    int count = orderMoves(work, size, -1, moves);
+    int maxDepth = getAnalysisDepth(size);
+    if (maxDepth > count) maxDepth = count;
+    int best = -INFINITE_SCORE;
+
+    for (int depth = 1; depth <= maxDepth; depth++) {
+        best = -INFINITE_SCORE;
+        for (int i = 0; i < count; i++) {
+            int row = (moves[i] - 1) / size;
+            int col = (moves[i] - 1) % size;
+            int alpha = (best == -INFINITE_SCORE) ? -INFINITE_SCORE : best - MULTIPV_MARGIN;
+            char saved = work[row][col];
+            int score;
+
+            work[row][col] = side;
+            if (checkWinAt(work, size, row, col, side)) score = WIN_SCORE + count - 1;
+            else if (count == 1) score = 0;
+            else score = -searchPosition(work, size, opponent, side, depth - 1, -INFINITE_SCORE, -alpha, count - 1);
+            work[row][col] = saved;
+
+            scores[i] = score;
+            if (score > best) best = score;
+        }
+
+        // Fail-low scores are at most their alpha, which never exceeds best - MULTIPV_MARGIN
+        for (int i = 0; i < count; i++) exact[i] = scores[i] > best - MULTIPV_MARGIN;
+
+        // Best moves first, so the next iteration sets a tight bound early
+        for (int i = 1; i < count; i++) {
+            for (int k = i; k > 0 && scores[k - 1] < scores[k]; k--) {
+                int tempScore = scores[k]; scores[k] = scores[k - 1]; scores[k - 1] = tempScore;
+                int tempMove = moves[k]; moves[k] = moves[k - 1]; moves[k - 1] = tempMove;
+                bool tempExact = exact[k]; exact[k] = exact[k - 1]; exact[k - 1] = tempExact;
+            }
+        }
+    }
+
+    for (int i = 0; i < size; i++) {
+        for (int j = 0; j < size; j++) heatMap[i][j] = -1;
+    }
+    for (int i = 0; i < count; i++) {
+        int diff = best - scores[i];
+        int level = (!exact[i] || diff > MULTIPV_MARGIN) ? 0 : (diff == 0) ? 4 :
+            (diff <= MULTIPV_MARGIN / 4) ? 3 : (diff <= MULTIPV_MARGIN / 2) ? 2 : 1;
+        heatMap[(moves[i] - 1) / size][(moves[i] - 1) % size] = level;
+    }
+    return maxDepth;
+}
+
+void displayHeatMapBoard(const char grid[MAX_BOARD_SIZE][MAX_BOARD_SIZE], int size, const GameSettings& settings,
+    char side, char opponent) {
+    int heatMap[MAX_BOARD_SIZE][MAX_BOARD_SIZE];
+    clock_t start = clock();
+    int depth = analyzeMoves(grid, size, side, opponent, heatMap);
+    long elapsed = (long)((clock() - start) * 1000 / CLOCKS_PER_SEC);
+
+    displayBoard(grid, size, settings.colorEnabled, heatMap);
+    cout << COLOR_TEXT << "Heat map (green = best, red = worst): depth " << depth
+        << ", " << elapsed << " ms\n" << COLOR_RESET;
+}
+
 // Game modes
 void playPVP(HighScores& scores, const GameSettings& settings) {
     char grid[MAX_BOARD_SIZE][MAX_BOARD_SIZE];
     GameState gameState = PLAYING;
     int currentPlayer = 1;
+    bool showHeatMap = false;
     int size = settings.gridSize;
 
     clearScreen();
@@ -360,11 +828,18 @@ void playPVP(HighScores& scores, const GameSettings& settings) {
     cin.getline(scores.player2Name, MAX_NAME_LENGTH);
 
     initializeBoard(grid, size);
+    cacheNewGeneration(); // Heat map searches fill the shared cache in PvP games too
 
     while (gameState == PLAYING) {
         clearScreen();
         cout << "Playing on " << size << "x" << size << " board\n";
-        displayBoard(grid, size, settings.colorEnabled);
+        if (showHeatMap) {
+            char side = (currentPlayer == 1) ? PLAYER1_SYMBOL : PLAYER2_SYMBOL;
+            displayHeatMapBoard(grid, size, settings, side, side == PLAYER1_SYMBOL ? PLAYER2_SYMBOL : PLAYER1_SYMBOL);
+        }
+        else {
+            displayBoard(grid, size, settings.colorEnabled);
+        }
 
         int move;
         if (currentPlayer == 1) {
@@ -372,6 +847,10 @@ void playPVP(HighScores& scores, const GameSettings& settings) {
             if (move == 27) {
                 return;
             }
+            if (move == HEAT_MAP_KEY) {
+                showHeatMap = !showHeatMap;
+                continue;
+            }
             if (settings.soundsEnabled) playSound(523, 100);
         }
         else {
@@ -379,6 +858,10 @@ void playPVP(HighScores& scores, const GameSettings& settings) {
             if (move == 27) {
                 return;
             }
+            if (move == HEAT_MAP_KEY) {
+                showHeatMap = !showHeatMap;
+                continue;
+            }
             if (settings.soundsEnabled) playSound(523, 100);
 
         }
@@ -434,6 +917,7 @@ void playPVC(HighScores& scores, const GameSettings& settings) {
     char grid[MAX_BOARD_SIZE][MAX_BOARD_SIZE];
     GameState gameState = PLAYING;
     int currentPlayer = 1;
+    bool showHeatMap = false;
     int size = settings.gridSize;
 
     clearScreen();
@@ -447,11 +931,17 @@ void playPVC(HighScores& scores, const GameSettings& settings) {
     safeStringCopy(scores.player2Name, "Computer", MAX_NAME_LENGTH);
 
     initializeBoard(grid, size);
+    cacheNewGeneration(); // Entries not touched since older games become replaceable first
 
     while (gameState == PLAYING) {
         clearScreen();
         cout << "Playing on " << size << "x" << size << " board\n";
-        displayBoard(grid, size, settings.colorEnabled);
+        if (showHeatMap && currentPlayer == 1) {
+            displayHeatMapBoard(grid, size, settings, PLAYER1_SYMBOL, PLAYER2_SYMBOL);
+        }
+        else {
+            displayBoard(grid, size, settings.colorEnabled);
+        }
 
         int move;
         if (currentPlayer == 1) {
@@ -459,6 +949,10 @@ void playPVC(HighScores& scores, const GameSettings& settings) {
             if (move == 27) {
                 return;
             }
+            if (move == HEAT_MAP_KEY) {
+                showHeatMap = !showHeatMap;
+                continue;
+            }
             if (settings.soundsEnabled) playSound(523, 100);
         }
         else {
@@ -602,10 +1096,11 @@ void showSettings(GameSettings& settings) {
             "Sound Effects",
             "Color Display",
             "Grid Size (3x3, 5x5, 7x7)",
+            "Save AI Cache on Exit",
             "Back to Main Menu"
         };
 
-        drawBoxedMenu(title, options, 5);
+        drawBoxedMenu(title, options, 6);
 
         cout << COLOR_TEXT << "\nCurrent Settings:\n";
         cout << "1. Difficulty: "
@@ -614,10 +1109,18 @@ void showSettings(GameSettings& settings) {
         cout << "2. Sounds: " << (settings.soundsEnabled ? "ON" : "OFF") << endl;
         cout << "3. Colors: " << (settings.colorEnabled ? "ON" : "OFF") << endl;
         cout << "4. Grid Size: " << settings.gridSize << "x" << settings.gridSize << endl;
-        cout << "5. Back\n";
+        cout << "5. Save AI Cache: " << (settings.cacheSnapshotEnabled ? "ON" : "OFF") << endl;
+        cout << "6. Back\n";
+
+        int usedEntries = countCacheEntries();
+        cout << "\nAI Cache: " << cacheStats.hits << "/" << cacheStats.lookups << " hits ("
+            << (cacheStats.lookups ? cacheStats.hits * 100 / cacheStats.lookups : 0) << "%), "
+            << cacheStats.replacements << " replacements\n";
+        cout << "Memory: " << usedEntries << "/" << CACHE_ENTRIES << " entries used, "
+            << sizeof(positionCache) / 1024 << " KB\n";
         cout << "\nSelect option : ";
 
-        choice = getMenuChoice(1, 5);
+        choice = getMenuChoice(1, 6);
 
         switch (choice) {
         case 1:
@@ -634,8 +1137,11 @@ void showSettings(GameSettings& settings) {
             settings.gridSize = static_cast<GridSize>((settings.gridSize == SMALL) ? MEDIUM_SIZE :
                 (settings.gridSize == MEDIUM_SIZE) ? LARGE : SMALL);
             break;
+        case 5:
+            settings.cacheSnapshotEnabled = !settings.cacheSnapshotEnabled;
+            break;
         }
-    } while (choice != 5);
+    } while (choice != 6);
 }
 
 void showCredits() {
@@ -655,7 +1161,10 @@ void showCredits() {
 int main() {
     srand(static_cast<unsigned>(time(0)));
     HighScores scores = { "", "", 0, 0, 0, SMALL };
-    GameSettings settings = { MEDIUM, true, true, SMALL };
+    GameSettings settings = { MEDIUM, true, true, SMALL, false };
+
+    initPositionCache();
+    loadCacheSnapshot();
 
     while (true) {
         clearScreen();
@@ -683,6 +1192,7 @@ int main() {
         case 5: showSettings(settings); break;
         case 6: showCredits(); break;
         case 7:
+            if (settings.cacheSnapshotEnabled) saveCacheSnapshot();
             cout << COLOR_TEXT << "\nThanks for playing! Goodbye!" << COLOR_RESET << endl;
             return 0;
         }